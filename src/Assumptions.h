@@ -27,10 +27,23 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <cmath>
 #include <ctime>
 #include <list>
+#include <set>
+#include <vector>
+#include <algorithm>
 #include "Global.h"
 #include "OccurVar.h"
+#include "Solver.h"
+#include "Symmetry.h"
 using namespace std;
 
+/*an assumption to test and the estimate of how hard it is*/
+
+typedef struct {
+	int *lits;	   /*literals of the assumption*/
+	int freeVars;	  /*variables left unassigned after propagating the literals on the master*/
+	double hardness;  /*estimated hardness, the greater the harder*/
+} Assump;
+
 /*Abstract class to make an assumptions generator with virtual methods to create the next assumption 
 to test and to report whether there are more assumptions to try*/
 
@@ -46,11 +59,52 @@ class AssumptionsMaker {
 	int getLimit(){return limit;}
 	virtual void makeAllAssumps(vec<OccurVar> & mostUsed);
 
+	/* estimates the hardness of the assumptions by propagating them on the master's solver and sorts them
+	   from the hardest to the easiest. Removes the assumptions refuted by the propagation and returns their number */
+	int estimateHardness(Solver & S);
+
+	/* removes the assumptions that are the image of a previous one by a generator of the symmetries of the
+	   formula, or by its inverse: both are satisfiable or not at the same time. Returns their number */
+	int mergeSymmetric(Symmetry & sym);
+
+	/* records the cpu time spent by a worker with an assumption. The pending assumptions are sorted again
+	   with this history each time the number of recorded times doubles */
+	void reportTime(int *assump, double cpuTime);
+
+	/* removes and returns the pending assumption nearest to the given one, the one with the fewest variables
+	   assumed differently (with the opposite polarity or in only one of them). Ties keep the order of the list */
+	int* nearestAssumption(int *last);
+
+	/* enlarges the arrays of the pending assumptions to the given size, to have room to split them */
+	void reserve(int size);
+
+	/* replaces an assumption that exhausted its conflict budget by its children with all the polarities of the
+	   given variables (ids starting at 1), at the head of the list. When the hardness is estimated, the solver
+	   of the master estimates the children too and closes the refuted ones (NULL otherwise).
+	   Returns the number of children kept */
+	int split(int *lits, int *vars, int nVars, Solver *S);
+
+	/* fills the given vector with the pending assumptions, in the order of the list */
+	void getPending(vec<int*> & pending);
+
     protected:
         int nAssumps; 	 /*number of variables to assume*/
 	long limit;	 /*total number of different assumptions*/
 	bool conflicts;  /*flag to remove assumptions based on conflicts*/
-	list<int*> allAssumps; /*list with all assumptions saved in arrays of integers*/
+	list<Assump> allAssumps; /*list with all assumptions saved in arrays of integers*/
+
+	/*adds an assumption to the end of the list*/
+	void addAssump(int *lits);
+
+    private:
+	vec<double> litTime;	/*sum of the cpu times of the assumptions with the literal (indexed by 2 * var + sign)*/
+	vec<int> litTests;	/*number of tested assumptions with the literal (indexed the same way)*/
+	double totalTime;	/*sum of the cpu times of all the tested assumptions*/
+	int nTimes, nextReschedule; /*number of recorded times and when to sort the pending assumptions again*/
+	vec<int> varMark;	/*literal of each variable in the assumption compared by nearestAssumption, or 0*/
+
+	/*how much slower than the average were the tested assumptions sharing literals with the given one*/
+	double historyFactor(int *lits);
 };
 
 /*Class for Equal search method*/
@@ -116,5 +170,50 @@ class MoreFirst : public Progressive {
 	void makeAllAssumps(vec<OccurVar> & mostUsed);
 };
 
+/*Class for Lookahead search method. The assumptions are the leaves of a tree built by lookahead on the
+master's solver: each node is split on the candidate variable that maximizes the product of the assignments
+propagated by both polarities, and the branches with failed literals are dropped.
+The assumptions may have a variable amount of literals, and their end is marked with the value 0*/
+
+class Lookahead : public AssumptionsMaker {
+    public:
+	/* receives the max number of variables to assume, the number of assumptions to make,
+	   the master's solver and the candidate variables to split on */
+        Lookahead(int nVars, int nLeaves, Solver & S, vec<OccurVar> & candidates);
+        ~Lookahead(){};
+
+	void makeAllAssumps(vec<OccurVar> & candidates);
+
+    private:
+	int targetLeaves;
+	Solver & solver;
+
+	/* chooses the variable to split the current node and fills the amount of assignments implied by each polarity
+	   (-1 for a failed literal). Returns var_Undef if all the candidates are assigned */
+	Var selectVar(vec<OccurVar> & candidates, int & posImplied, int & negImplied);
+};
+
+/*Class for the blocks of the sub-masters in the hierarchical mode. The block of an assumption received from the
+master has its children with all the polarities of the most used candidates left unassigned by its propagation on
+the solver of the sub-master. It is empty if the propagation refutes the assumption*/
+
+class Block : public AssumptionsMaker {
+    public:
+	/* receives the size of the arrays, the assumption of the master, the max number of variables to add,
+	   the solver of the sub-master and the candidate variables, sorted from the least to the most used */
+        Block(int size, int *lits, int nVars, Solver & S, vec<OccurVar> & candidates);
+        ~Block(){};
+};
+
+/*Class for the assumptions read from a checkpoint of the master, to resume its search. They are kept in the order
+they were written, the one of the list of the interrupted execution*/
+
+class Resumed : public AssumptionsMaker {
+    public:
+	/* receives the size of the arrays and the literals of the assumptions, each one ended by a 0 */
+        Resumed(int size, vec<int> & lits);
+        ~Resumed(){};
+};
+
 #endif
 
@@ -0,0 +1,89 @@
+/*PMSat -- Copyright (c) 2006-2007, Lus Gil
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+#ifndef CODEC_H
+#define CODEC_H
+
+#include "Global.h"
+
+/*
+Compact encoding of the arrays exchanged by the master and the workers when the compress option is enabled.
+
+- Clauses (learnt clauses and facts), given as literals separated by zeros: each literal is mapped to the
+  code 2 * |lit| - (lit < 0), the codes of each clause are sorted and written as the varint of the first one
+  followed by the varints of the differences to the previous one. As neither is zero, a zero ends the clause.
+- Assumptions, given as arrays of cubeSize literals ending with a zero when shorter: the varint of the number
+  of literals followed by their codes packed with litBits bits each.
+- Models, given as the literals of the assigned variables: 2 bits per variable, 0 if it is unassigned,
+  1 if it is true and 2 if it is false.
+
+Varints have 7 bits per byte, the lowest first, and the high bit set in all the bytes but the last.
+Literals are variable ids starting at 1, negative when negated, as everywhere else in the messages.
+*/
+
+#define CLAUSES_MAX_BYTES(n) (5 * (n))	// max number of bytes of n integers of clauses, once encoded
+
+class Codec {
+
+private:
+
+	int nVars;	// number of variables of the formula
+	int litBits;	// bits of the code of a literal in an assumption
+	vec<uint> codes; // codes of the clause being encoded
+
+public:
+
+	/*Constructor, receives the number of variables of the formula*/
+
+	Codec(int nVars);
+
+	/* max number of bytes of an encoded assumption or model */
+
+	int cubeMaxBytes(int cubeSize);
+	int modelMaxBytes();
+
+	/* encodes size integers of clauses separated by zeros to out. Returns the number of bytes written */
+
+	int encodeClauses(const int *clauses, int size, uchar *out);
+
+	/* decodes nBytes of encoded clauses to the array, with the clauses separated by zeros. Returns its size */
+
+	int decodeClauses(const uchar *in, int nBytes, int *clauses);
+
+	/* encodes an assumption of at most cubeSize literals to out. Returns the number of bytes written */
+
+	int encodeCube(const int *lits, int cubeSize, uchar *out);
+
+	/* decodes an assumption to an array of cubeSize literals, ending with a zero when shorter */
+
+	void decodeCube(const uchar *in, int cubeSize, int *lits);
+
+	/* encodes the model given by size literals to out. Returns the number of bytes written */
+
+	int encodeModel(const int *model, int size, uchar *out);
+
+	/* decodes a model to the literals of the assigned variables. Returns their number */
+
+	int decodeModel(const uchar *in, int *model);
+};
+
+#endif
@@ -0,0 +1,77 @@
+/*PMSat -- Copyright (c) 2006-2007, Lus Gil
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#ifndef GAUSS_H
+#define GAUSS_H
+
+#include "SolverTypes.h"
+
+/*
+XOR constraints of the formula, detected from their CNF encoding (the 2^(k-1) clauses over the same k variables
+that exclude the assignments of the wrong parity), for a propagator by Gaussian elimination. Each constraint is a
+row: a bit-packed vector over the columns (the variables of the constraints) and a parity, so that the rows are
+added 64 columns at a time.
+
+The rows are reduced once at decision level 0. Under a partial assignment, propagate() folds the assigned columns
+into the parities and eliminates on the unassigned ones: a row left with no column and parity 1 is a conflict, and
+a row with one column implies its variable. Each one is given as a clause, with the implied literal first and the
+other variables of the row (a sum of constraints, all assigned) as false literals, to be its reason in the Solver.
+*/
+
+#define GAUSS_MAX_SIZE 6		// max variables of the XOR constraints detected (encoded by 2^(size-1) clauses)
+#define GAUSS_MAX_WORK (1 << 22)	// max rows * rows * words of the matrix eliminated at every fixpoint
+
+class Gauss {
+	int n_words;		//64-bit words of each row
+	vec<Var> col_var;	//variable of each column
+	vec<int> var_col;	//column of each variable, or -1
+	vec<Var> row_vars;	//variables of each row found by detect(), ended by var_Undef (until reduce())
+	vec<uint64> rows;	//columns of each row, 'n_words' words per row
+	vec<char> parity;	//parity of each row
+	vec<int> pivot;		//column of each row after reduce(), in no other row
+	vec<uint64> full, free;	//rows of the elimination of propagate(): all their columns and the unassigned ones
+	vec<char> sum;		//and their parities, with the values of the assigned columns added
+	vec<uint64> assigned, truth;	//columns assigned and columns true
+
+	void addRow(const Var *xs, int size, bool odd);
+
+public:
+	Gauss() : n_words(0) {}
+
+	int nRows() const { return parity.size(); }
+	int nCols() const { return col_var.size(); }
+	int column(Var x) const { return x < var_col.size() ? var_col[x] : -1; }
+
+	/* adds the XOR constraints encoded by 'clauses' (the problem clauses) and returns how many */
+	int detect(const vec<Clause*> &clauses, int n_vars);
+
+	/* Gauss-Jordan elimination of the rows: FALSE if they are inconsistent. A matrix too large to be eliminated
+	   at every fixpoint (GAUSS_MAX_WORK) is dropped afterwards, the clauses still encode it */
+	bool reduce();
+
+	/* eliminates under 'assigns' (the lbool of each variable as a char): returns TRUE with the conflict clause
+	   in 'out', or FALSE with the implications, the clause i ending at out[lims[i]] */
+	bool propagate(const vec<char> &assigns, vec<Lit> &out, vec<int> &lims);
+};
+
+#endif
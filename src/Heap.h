@@ -70,6 +70,7 @@ class Heap {
     bool inHeap    (int n)    { assert(ok(n)); return indices[n] != 0; }
     void increase  (int n)    { assert(ok(n)); assert(inHeap(n)); percolateUp(indices[n]); }
     bool empty     ()         { return heap.size() == 1; }
+    int  top       ()         { assert(!empty()); return heap[1]; }
 
     void insert(int n) {
         assert(ok(n));
@@ -25,6 +25,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "Global.h"
 
+#define QUOTA_RANGE 4		// the adaptive limits go from the initial ones divided to multiplied by this factor
+#define USEFUL_HIGH 0.10	// ratio of useful clauses to double the amount of a worker and raise its size
+#define USEFUL_LOW 0.02		// ratio of useful clauses under which its amount is halved and its size lowered
+
 /*
 Class to implement a database to save the learnt clauses created by the solver and sent by the workers to the master.
 The database has the following behaviour:
@@ -42,6 +46,12 @@ The main concern is send to each worker only new information.
 - When is needed to choose an array to send to a given worker, we choose an array from a different worker,
   after confirming that the worker is not in the list of receivers of that array.
 
+When the adaptive limits are enabled, the database also keeps the max amount and size of the learnt clauses
+that each worker may send. The receivers report how many clauses of the last array they got became unit or
+conflicting during their solve, which is credited to the worker that sent it. Each time the reports about a
+worker sum up as many clauses as its amount, its limits are raised if at least USEFUL_HIGH of the clauses
+were useful and lowered if less than USEFUL_LOW were, within QUOTA_RANGE times the initial values.
+
 
 */
 
@@ -52,6 +62,12 @@ private:
 	int currentPos; // for round robin
 	vec<int> learntsSize; //number of literals and separators on the i-th array in learntsFrom vector
 	vec< vec<int> > receivers; //workers that already received the i-th set of learnt clauses from vector learntsFrom
+	vec<int> lastFrom; //worker that sent the last array given to the i-th worker, or 0
+
+	int minAmount, maxAmount, minSize, maxSize; //bounds of the adaptive limits
+	vec<int> quotaAmount, quotaSize; //current limits of the learnt clauses sent by the i-th worker
+	vec<int> reported, useful; //clauses of the i-th worker reported by the receivers since its last change and how many were useful
+	vec<char> quotaChanged; //the limits of the i-th worker changed since the last call to getQuota
 
 public:
 
@@ -70,6 +86,19 @@ public:
 
 	int* getLearnts(int toCpu, int & learntSize);
 
+	/* Enables the adaptive limits of every worker, starting at the given max amount and size of the learnt clauses */
+	void adaptQuotas(int amount, int size);
+
+	/* Credits to the sender of the last array given to a cpu the number of clauses the cpu received and how many of
+	   them were useful, and adapts the limits of the sender when the reports sum up its amount */
+	void reportUsefulness(int toCpu, int received, int nUseful);
+
+	/* Fills the current limits of a worker. Returns true if they changed since the last call */
+	bool getQuota(int cpu, int & amount, int & size);
+
+	/* Gets the last learnt clauses added by a cpu, whoever received them. May return NULL if it added none */
+	int* lastLearnts(int fromCpu, int & learntSize);
+
 };
 
 #endif
@@ -23,18 +23,37 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #ifndef MESSAGES_H
 #define MESSAGES_H
 
+#include "Global.h"
+
 #define MAX_CONFLICTS 20
+#define SPLIT_VARS 2		// variables sent by a worker to split an assumption that exhausted its conflict budget
+#define RESULT_UNKNOWN 2	// result of an assumption that exhausted its conflict budget
 
-/*message types used in communication by the worker to indicate the format of the solve*/
+/*message types used in communication by the worker to indicate the format of the solve.
+The fields are grouped by type (int, double, int64) to build the MPI datatype with three blocks*/
 
 typedef struct {
-	int result; 		       // true or false
+	int result; 		       // true, false or RESULT_UNKNOWN
 	int conflict[MAX_CONFLICTS];  //conflict vector
 	int conflictSize; 	     // conflict size (number of literals in the array)
 	int moreMsgs;  		    // are there more messages to send ?  
+	int totalConflict;	   // number of literals of the whole conflict, possibly split over several messages
+	int learntsSent;	   // number of learnt clauses sent to the master after the solve
+	int learntsReceived;	   // number of learnt clauses received from the master before the solve
+	int learntsUseful;	   // number of received learnt clauses that became unit or conflicting for the first time in the solve
+	int splitSize;		   // number of variables in splitVars
+	int splitVars[SPLIT_VARS]; // most active free variables (ids starting at 1) to split an unknown assumption
 	double cpuTime; 	   // total cpu time spent by one worker, since the end of initialization  
+	double wallTime;	   // wall time of the solve call
+	int64 decisions;	   // decisions, conflicts and propagations made by the solve call
+	int64 conflicts;
+	int64 propagations;
 }Result;
 
+#define RESULT_INTS (8 + MAX_CONFLICTS + SPLIT_VARS)	// number of int fields of Result
+#define RESULT_DOUBLES 2		// number of double fields of Result
+#define RESULT_INT64S 3			// number of int64 fields of Result
+
 /* struct to store the relevant options and values */
 
 typedef struct {
@@ -48,6 +67,22 @@ typedef struct {
 	bool verbose;		//enable verbose mode ?
 	char searchMode;	//type of search mode
 	char varChoiceMode;	//type of mode to select the variables to assume
+	bool estimate;		//should estimate the hardness of the assumptions and test the hardest first ?
+	char cubeReport;	//format of the report with the statistics of each assumption: json, csv or none (0)
+	bool affinity;		//should send to each worker the pending assumption nearest to its last one ?
+	int conflictBudget;	//conflicts allowed to each assumption before it is split (0 for no limit)
+	int cubeSize;		//size of the arrays of the assumptions: nVars plus the room to split them
+	bool shareFacts;	//should broadcast the learnt unit and binary clauses ?
+	bool adaptiveLearnts;	//should adapt the learnt clauses shared by each worker to their usefulness ?
+	bool compress;		//should encode the assumptions, clauses and models sent with the Codec ?
+	int chronoBacktrack;	//decision levels a backjump may undo before the solvers backtrack chronologically instead (0 for never)
+	bool gauss;		//should the solvers propagate the XOR constraints of the formula by Gaussian elimination ?
+	char symmetry;		//use of the symmetries of the formula: breaking clauses, merge of the symmetric assumptions or none (0)
+	int localSearch;	//percentage of the workers that run local search instead of testing assumptions
+	int warmup;		//conflicts of the search of the master before making the assumptions (0 for none)
+	int groupSize;		//max processes of the group of each sub-master in the hierarchical mode (0 for a single master)
+	int checkpoint;		//seconds between the checkpoints of the search written by the master (0 for none)
+	bool resume;		//should the master resume the search from its checkpoint ?
 } Options;
 
 #endif
@@ -0,0 +1,75 @@
+/*PMSat -- Copyright (c) 2006-2007, Lus Gil
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#ifndef PROBSAT_H
+#define PROBSAT_H
+
+#include "Solver.h"
+
+/*
+Stochastic local search by probSAT over the problem clauses of a Solver: a false clause is picked at random and one
+of its variables is flipped, with a probability that decreases with its break value (the number of clauses that
+would become false). The clauses are stored in one flat array, and so are the clauses of each literal, and the break
+values are kept up to date by each flip: a clause knows how many true literals it has and the XOR of their variables,
+which is the only one (the critical variable) when it has one.
+*/
+
+#define PROBSAT_MAX_BREAK 64	// break values with their own probability (the greater ones take the last)
+
+class ProbSAT {
+	int n_vars;
+	vec<Lit> lits;			//literals of the clauses, the clause c in lits[start[c]] .. lits[start[c+1] - 1]
+	vec<int> start;
+	vec<int> occ, occ_start;	//clauses of each literal (by index()), the same way
+	vec<char> value;		//current assignment (TRUE for the positive literal)
+	vec<int> num_true, crit;	//true literals of each clause and the XOR of their variables
+	vec<int> breaks;		//clauses of each variable with it as the only true literal
+	vec<int> unsat, where;		//false clauses and the position of each one in 'unsat' (-1 if true)
+	vec<double> probs;		//probability of each break value, not normalized
+	vec<double> weights;		//probability of each literal of the false clause picked (sized to the longest)
+	vec<char> best;			//assignment with the fewest false clauses so far, unless 'best_current'
+	bool best_current;		//the best is the current assignment with the variables of 'since' flipped back
+	vec<Var> since;			//(saves copying the whole assignment at each improvement)
+	int best_unsat;
+	uint64 seed;
+	int64 flips;
+
+	void flip(Var x);
+	uint64 rand64() { seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17; return seed; }
+
+public:
+	/* takes the problem clauses of 'S' (at decision level 0), from a random assignment given by 'seed' */
+	ProbSAT(Solver &S, uint64 seed);
+
+	/* flips until every clause is true (returns TRUE) or 'max_flips' are done */
+	bool run(int64 max_flips);
+
+	int nVars() const { return n_vars; }
+	int64 nFlips() const { return flips; }
+	int bestUnsat() const { return best_unsat; }
+
+	/* the best assignment so far (the model after run() returned TRUE), as signed variable ids starting at 1 */
+	void bestAssignment(int *out) const;
+};
+
+#endif
@@ -23,6 +23,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "SolverTypes.h"
 #include "VarOrder.h"
+#include "Gauss.h"
 
 // Redfine if you want output to go somewhere else:
 #define reportf(format, args...) ( printf(format , ## args), fflush(stdout) )
@@ -35,8 +36,27 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 struct SolverStats {
     int64   starts, decisions, propagations, conflicts;
     int64   clauses_literals, learnts_literals, max_literals, tot_literals;
+    int64   saved_propagations;     // Assignments kept on the trail by partial restarts and reused assumptions instead of propagated again.
+    int64   imports_used;           // Clauses added by 'addLearnts()' that became unit or conflicting for the first time.
+    int64   bin_literals;           // Conflict clause literals removed through the binary implication graph (part of 'max_literals - tot_literals').
+    int64   strengthened;           // Reason clauses that lost their implied literal because the resolvent of 'analyze()' subsumed them.
+    int64   vivified, vivified_literals;    // Learnt clauses tried by 'vivifyLearnts()' and literals it removed from them.
+    int64   chrono_backtracks, chrono_saved;    // Conflicts undone by chronological backtracking instead of a backjump, and the assignments it kept.
+    int64   xor_implied, xor_conflicts;         // Implications and conflicts found by the Gaussian elimination over the XOR constraints.
     SolverStats() : starts(0), decisions(0), propagations(0), conflicts(0)
-      , clauses_literals(0), learnts_literals(0), max_literals(0), tot_literals(0) { }
+      , clauses_literals(0), learnts_literals(0), max_literals(0), tot_literals(0), saved_propagations(0), imports_used(0)
+      , bin_literals(0), strengthened(0), vivified(0), vivified_literals(0), chrono_backtracks(0), chrono_saved(0)
+      , xor_implied(0), xor_conflicts(0) { }
+};
+
+
+// Data of a variable read together by the conflict analysis, packed to be fetched in one cache line:
+//
+struct VarData {
+    GClause reason;     // Clause that implied the current value of the variable, or 'NULL' if none.
+    int     level;      // Decision level of the assignment: the highest one of its reason, which may be below the current one.
+    char    seen;       // Mark of 'analyze()', 'analyze_removable()' and 'analyzeFinal()'; always cleared on return.
+    VarData() : reason(GClause_NULL), level(-1), seen(0) { }
 };
 
 
@@ -54,7 +74,7 @@ protected:
     bool                ok;               // If FALSE, the constraints are already unsatisfiable. No part of the solver state may be used!
     vec<Clause*>        clauses;          // List of problem clauses.
     vec<Clause*>        learnts;          // List of learnt clauses.
-    int                 n_bin_clauses;    // Keep track of number of binary clauses "inlined" into the watcher lists (we do this primarily to get identical behavior to the version without the binary clauses trick).
+    int                 n_bin_clauses;    // Keep track of number of binary clauses kept in 'bin_watches' (we do this primarily to get identical behavior to the version without the binary clauses trick).
     double              cla_inc;          // Amount to bump next clause with.
     double              cla_decay;        // INVERSE decay factor for clause activity: stores 1/decay.
 
@@ -63,20 +83,31 @@ protected:
     double              var_decay;        // INVERSE decay factor for variable activity: stores 1/decay. Use negative value for static variable order.
     VarOrder            order;            // Keeps track of the decision variable order.
 
-    vec<vec<GClause> >  watches;          // 'watches[lit]' is a list of constraints watching 'lit' (will go there if literal becomes true).
+    vec<vec<GClause> >  watches;          // 'watches[lit]' is a list of the other clauses of 3 or more literals watching 'lit' (will go there if literal becomes true).
+    vec<vec<Lit> >      bin_watches;      // 'bin_watches[lit]' lists the literals implied by 'lit' through binary clauses (the binary implication graph).
+    vec<vec<TernaryWatch> > tern_watches; // 'tern_watches[lit]' lists the ternary problem clauses with '~lit', which are watched on all their literals.
     vec<char>           assigns;          // The current assignments (lbool:s stored as char:s).
+    vec<char>           lit_values;       // 'lit_values[index(lit)]' is the current value of 'lit', kept with 'assigns' to spare 'propagate()' the sign flip.
     vec<Lit>            trail;            // Assignment stack; stores all assigments made in the order they were made.
     vec<int>            trail_lim;        // Separator indices for different decision levels in 'trail'.
-    vec<GClause>        reason;           // 'reason[var]' is the clause that implied the variables current value, or 'NULL' if none.
-    vec<int>            level;            // 'level[var]' is the decision level at which assignment was made.
+    vec<VarData>        vardata;          // 'vardata[var]' holds the reason, decision level and analysis mark of the variable.
+    vec<char>           polarity;         // 'polarity[var]' is the sign of the decisions on the variable (TRUE, negative, unless set by 'setPhases()').
     int                 root_level;       // Level of first proper decision.
+    vec<Lit>            root_assumps;     // Assumptions of the decision levels kept on the trail after 'solve()', reused by the next call if they are a prefix of its assumptions.
+    vec<int>            facts;            // Learnt unit and binary clauses not yet taken by 'getFacts()', encoded as in 'getLearnts()'.
     int                 qhead;            // Head of queue (as index into the trail -- no more explicit propagation queue in MiniSat).
+    int                 bin_qhead;        // Head of queue for the binary implications, never behind 'qhead'.
     int                 simpDB_assigns;   // Number of top-level assignments since last execution of 'simplifyDB()'.
     int64               simpDB_props;     // Remaining number of propagations that must be made before next execution of 'simplifyDB()'.
+    int64               vivify_conflicts; // Number of conflicts from which the next execution of 'vivifyLearnts()' is due.
+    int64               vivify_props;     // Number of propagations at the end of the last execution of 'vivifyLearnts()'.
+    Gauss               xors;             // XOR constraints of the problem clauses, propagated by Gaussian elimination if 'gauss' is set.
+    bool                xors_detected;    // 'xors' holds the constraints of the problem clauses (detected once, by 'simplifyDB()').
+    int                 gauss_qhead;      // Head of queue for 'gaussPropagate()', which runs only if a variable of 'xors' was assigned.
+    bool                gauss_dirty;      // Forces the next 'gaussPropagate()' (after the detection).
 
     // Temporaries (to reduce allocation overhead). Each variable is prefixed by the method in which is used:
     //
-    vec<char>           analyze_seen;
     vec<Lit>            analyze_stack;
     vec<Lit>            analyze_toclear;
     Clause*             propagate_tmpbin;
@@ -84,6 +115,10 @@ protected:
     Clause*             solve_tmpunit;
     vec<Lit>            addBinary_tmp;
     vec<Lit>            addTernary_tmp;
+    vec<Lit>            cancelUntil_kept;
+    vec<Lit>            gaussPropagate_out;
+    vec<int>            gaussPropagate_lims;
+    vec<Lit>            gaussPropagate_tmp;
 
     // Main internal methods:
     //
@@ -94,11 +129,15 @@ protected:
     void        analyze          (Clause* confl, vec<Lit>& out_learnt, int& out_btlevel); // (bt = backtrack)
     bool        analyze_removable(Lit p, uint min_level);                                 // (helper method for 'analyze()')
     void        analyzeFinal     (Clause* confl,  bool skip_first = false);
-    bool        enqueue          (Lit fact, GClause from = GClause_new((Clause*)NULL));
+    bool        enqueue          (Lit fact, GClause from = GClause_new((Clause*)NULL), int level = -1);  // (level -1 is the current decision level)
+    int         conflictLevel    (Clause* confl, bool& single);
     Clause*     propagate        ();
+    Clause*     gaussPropagate   ();
     void        reduceDB         ();
+    void        vivifyLearnts    ();
     Lit         pickBranchLit    (const SearchParams& params);
     lbool       search           (int nof_conflicts, int nof_learnts, const SearchParams& params);
+    int         restartLevel     ();
     double      progressEstimate ();
 
     // Activity:
@@ -116,8 +155,15 @@ protected:
     //
     void     newClause(const vec<Lit>& ps, bool learnt = false);
     void     claBumpActivity (Clause* c) { if ( (c->activity() += cla_inc) > 1e20 ) claRescaleActivity(); }
+    void     watchBinary     (Lit p, Lit q) { bin_watches[index(~p)].push(q); bin_watches[index(~q)].push(p); n_bin_clauses++; }
+    bool     ternary         (const Clause* c) const { return c->size() == 3 && !c->learnt(); }    // (kept in 'tern_watches' instead of 'watches')
+    void     watchTernary    (Clause* c);
     void     remove          (Clause* c, bool just_dealloc = false);
-    bool     locked          (const Clause* c) const { GClause r = reason[var((*c)[0])]; return !r.isLit() && r.clause() == c; }
+    void     strengthenReason(Clause& c);
+    void     pushFact        (const vec<Lit>& ps) {     // (a learnt unit or binary clause, for 'getFacts()')
+        for (int i = 0; i < ps.size(); i++) facts.push(sign(ps[i]) ? -(var(ps[i]) + 1) : var(ps[i]) + 1);
+        facts.push(0); }
+    bool     locked          (const Clause* c) const { GClause r = vardata[var((*c)[0])].reason; return !r.isLit() && r.clause() == c; }
     bool     simplify        (Clause* c) const;
 
     int      decisionLevel() const { return trail_lim.size(); }
@@ -131,10 +177,22 @@ public:
              , var_decay        (1)
              , order            (assigns, activity)
              , qhead            (0)
+             , bin_qhead        (0)
              , simpDB_assigns   (0)
              , simpDB_props     (0)
+             , vivify_conflicts (0)
+             , vivify_props     (0)
+             , xors_detected    (false)
+             , gauss_qhead      (0)
+             , gauss_dirty      (false)
              , default_params   (SearchParams(0.95, 0.999, 0.02))
              , expensive_ccmin  (true)
+             , binary_ccmin     (true)
+             , otf_subsumption  (true)
+             , vivify           (true)
+             , share_facts      (false)
+             , chrono_backtrack (0)
+             , gauss            (false)
              , verbosity        (0)
              , progress_estimate(0)
              {
@@ -154,7 +212,8 @@ public:
     // Helpers: (semi-internal)
     //
     lbool   value(Var x) const { return toLbool(assigns[x]); }
-    lbool   value(Lit p) const { return sign(p) ? ~toLbool(assigns[var(p)]) : toLbool(assigns[var(p)]); }
+    lbool   value(Lit p) const { return toLbool(lit_values[index(p)]); }
+    const vec<Lit>& binImplied(Lit p) const { return bin_watches[index(p)]; }   // Literals implied by 'p' through binary clauses.
 
     int     nAssigns() { return trail.size(); }
     int     nClauses() { return clauses.size() + n_bin_clauses; }   // (minor difference from MiniSat without the GClause trick: learnt binary clauses will be counted as original clauses)
@@ -168,6 +227,12 @@ public:
     //
     SearchParams    default_params;     // Restart frequency etc.
     bool            expensive_ccmin;    // Controls conflict clause minimization. TRUE by default.
+    bool            binary_ccmin;       // Removes from conflict clauses the literals whose negation is implied by a binary clause of the negated asserting literal. TRUE by default.
+    bool            otf_subsumption;    // Strengthens during 'analyze()' the reason clauses subsumed by the resolvent. TRUE by default.
+    bool            vivify;             // Vivifies the most active learnt clauses at decision level 0 every few conflicts. TRUE by default.
+    bool            share_facts;        // Keep the learnt unit and binary clauses to be taken by 'getFacts()'. FALSE by default.
+    int             chrono_backtrack;   // Backjumps over more than this many decision levels undo only the conflict level instead (0 means never). 0 by default.
+    bool            gauss;              // Propagates the XOR constraints encoded by the problem clauses by Gaussian elimination. FALSE by default.
     int             verbosity;          // Verbosity level. 0=silent, 1=some progress report, 2=everything
 
     // Problem specification:
@@ -184,7 +249,8 @@ public:
     //
     bool    okay() { return ok; }       // FALSE means solver is in an conflicting state (must never be used again!)
     void    simplifyDB();
-    bool    solve(const vec<Lit>& assumps);
+    lbool   solveLimited(const vec<Lit>& assumps, int64 max_conflicts);    // (gives up with 'l_Undef' after 'max_conflicts' conflicts, if not negative)
+    bool    solve(const vec<Lit>& assumps) { return solveLimited(assumps, -1) == l_True; }
     bool    solve() { vec<Lit> tmp; return solve(tmp); }
 
     /* new code by Lus Gil */
@@ -192,13 +258,44 @@ public:
     /*get an array with a set of clauses encoded as integers and separated by zeros*/
     void getLearnts(int maxAmount, int maxSize, int *learntsBuffer, int & resultSize);
 
-    /*adds to the learnts database the clauses included in the array that is returned by the previous function*/
+    /*adds to the learnts database the clauses included in the array that is returned by the previous function.
+      They are tagged as imported until they first propagate or conflict, which is counted in stats.imports_used*/
     void addLearnts(int *learntsBuffer, int size);
 
+    /*moves to the array the unit and binary clauses learnt since the last call, encoded as integers and separated
+      by zeros. They hold at the root level, whatever the assumptions. Stops at the first one that does not fit in maxSize*/
+    void getFacts(int maxSize, int *factsBuffer, int & resultSize);
+
+    /*adds at the root level the unit and binary clauses included in the array returned by the previous function*/
+    void addFacts(int *factsBuffer, int size);
+
     /*deletes all learnt clauses from the solver*/
 
     void dellAllLearnts();
 
+    /* primitives for the lookahead made by the master to build the cubes */
+
+    /*opens a new decision level with the literal p and propagates it. Returns false on conflict*/
+    bool assumeAndPropagate(Lit p);
+
+    /*number of assignments implied by p under the current assumptions, or -1 if p is a failed literal*/
+    int probe(Lit p);
+
+    /*undoes the assumptions made above the given decision level*/
+    void backtrack(int level) {
+        cancelUntil(level);
+        if (root_assumps.size() > level) root_assumps.shrink(root_assumps.size() - level); }
+
+    /*fills vars with the n most active variables that are not assigned*/
+    void mostActiveVars(int n, vec<Var> & vars);
+
+    /*fills lits with the problem clauses, the binary ones and the facts of the root level included, the clause i
+      ending at lits[lims[i]]. To be called before the search (the binary clauses learnt are not told apart)*/
+    void problemClauses(vec<Lit> & lits, vec<int> & lims);
+
+    /*the decisions on the variables of the array (signed ids starting at 1) take their polarity from then on*/
+    void setPhases(const int *lits, int size);
+
     /* end of new code */
 
     double      progress_estimate;  // Set by 'search()'.
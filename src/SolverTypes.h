@@ -77,17 +77,24 @@ public:
 
     // NOTE: This constructor cannot be used directly (doesn't allocate enough memory).
     Clause(bool learnt, const vec<Lit>& ps) {
-        size_learnt = (ps.size() << 1) | (int)learnt;
+        size_learnt = (ps.size() << 3) | (int)learnt;
         for (int i = 0; i < ps.size(); i++) data[i] = ps[i];
         if (learnt) activity() = 0; }
 
     // -- use this function instead:
 
-    int       size        ()      const { return size_learnt >> 1; }
+    int       size        ()      const { return size_learnt >> 3; }
     bool      learnt      ()      const { return size_learnt & 1; }
+    bool      imported    ()      const { return size_learnt & 2; }     // (learnt clause received from another worker that was not used yet)
+    void      setImported (bool b)      { size_learnt = (size_learnt & ~2u) | ((uint)b << 1); }
+    bool      vivified    ()      const { return size_learnt & 4; }     // (learnt clause already strengthened by 'vivifyLearnts()')
+    void      setVivified (bool b)      { size_learnt = (size_learnt & ~4u) | ((uint)b << 2); }
     Lit       operator [] (int i) const { return data[i]; }
     Lit&      operator [] (int i)       { return data[i]; }
     float&    activity    ()      const { return *((float*)&data[size()]); }
+    void      pop         ()            {     // (drops the last literal, moving the activity of a learnt clause after the new last one)
+        if (learnt()){ float a = activity(); size_learnt -= 1 << 3; activity() = a; }
+        else         size_learnt -= 1 << 3; }
 };
 
 extern Clause* Clause_new(bool learnt, const vec<Lit>& ps); //{
@@ -118,5 +125,20 @@ extern GClause GClause_new(Clause* c); //{ assert(((uintp)c & 1) == 0); return G
 #define GClause_NULL GClause_new((Clause*)NULL)
 
 
+//=================================================================================================
+// TernaryWatch -- a ternary clause as seen from the watch of one of its literals:
+
+
+// Holds the other two literals, so the clause itself is only reached when it implies or conflicts.
+class TernaryWatch {
+public:
+    Lit         other[2];
+    Clause*     clause;
+    TernaryWatch(Lit p = lit_Undef, Lit q = lit_Undef, Clause* c = NULL) : clause(c) { other[0] = p; other[1] = q; }
+
+    bool        operator == (const TernaryWatch& w) const { return clause == w.clause; }   // (a clause has one watch per list)
+};
+
+
 //=================================================================================================
 #endif
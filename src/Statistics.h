@@ -36,15 +36,31 @@ typedef struct {
 	int nSolveCalls; // number of times solve() was called and finished
 	int sentDB; 	 // number of databases sent to the master 
 	int receivedDB;	 // number of received databases from the master
+	int learntsReceived; // number of learnt clauses received from the master
+	int learntsUseful;   // number of them that became unit or conflicting in the solve after their reception
+	int64 traffic;	 // bytes of assumptions, clauses and models exchanged with the master
 } workerStats;
 
+typedef struct {
+	int worker;	// worker that tested the assumption
+	int *lits;	// literals of the assumption, ending with 0 when shorter than the number of variables to assume
+	Result result;	// last message of the worker about the assumption
+} cubeStats;
+
 class Statistics {
 
 private:
 
 	int nWorkers, erasedAssumps; //number of workers, number of assumed variables and number of erased assumptions
+	int refutedAssumps; //number of assumptions refuted by the master while estimating their hardness
+	int splitAssumps;   //number of assumptions split after exhausting their conflict budget
+	int mergedAssumps;  //number of assumptions merged with a symmetric one
+	int phasesReceived; //number of assignments received from the local search workers
+	int resumedAssumps; //number of assumptions resumed from the checkpoint of the master
+	int checkpoints;    //number of checkpoints written by the master
 
 	vec<workerStats> stats; // stats for each worker
+	vec<cubeStats> cubes;	// stats for each tested assumption, in the order the results arrived
 
 	double init, end;    //init and end times used for several measures
 	double initMaster, endMaster; // init and end times to measure the time spent by master master
@@ -59,7 +75,7 @@ private:
 public:
 
 	/*constructor and destructor*/
-	Statistics() : nWorkers(0), erasedAssumps(0), init(0), end(0)  {}
+	Statistics() : nWorkers(0), erasedAssumps(0), refutedAssumps(0), splitAssumps(0), mergedAssumps(0), phasesReceived(0), resumedAssumps(0), checkpoints(0), init(0), end(0)  {}
 	~Statistics() {}
 
 	/*sets the number of cpus and initializes the stats data structure*/
@@ -68,12 +84,36 @@ public:
 	/* increases by n the number of erased assumptions */
 	void increaseErased(int n);
 
+	/* increases by n the number of assumptions refuted by the master */
+	void increaseRefuted(int n);
+
+	/* increases the number of assumptions split after exhausting their conflict budget */
+	void increaseSplit();
+
+	/* increases by n the number of assumptions merged with a symmetric one */
+	void increaseMerged(int n);
+
+	/* increases the number of assignments received from the local search workers */
+	void increasePhases();
+
+	/* increases by n the number of assumptions resumed from the checkpoint of the master */
+	void increaseResumed(int n);
+
+	/* increases the number of checkpoints written by the master */
+	void increaseCheckpoints();
+
 	/* increases the number of databases (with learnt clauses) received from the master*/
 	void increaseReceived(int worker);
 
 	/* increases the number of databases (with learnt clauses) sent by the worker*/
 	void increaseSent(int worker);
 
+	/* increases the number of learnt clauses received by the worker and of those that were useful */
+	void increaseUseful(int worker, int received, int useful);
+
+	/* increases the bytes of assumptions, clauses and models exchanged by the master with the worker */
+	void increaseTraffic(int worker, int bytes);
+
 	/*To start measure the time. To be called just before a send, receive or solve().*/
 	void startMeasure();
 
@@ -114,6 +154,15 @@ public:
 	/*... or to a xml file to be parsed to collect the statistics*/
 	int write2xml(bool parallel, char * fileName, Options & opts);
 
+	/*records the result of an assumption tested by a worker*/
+	void addCube(int worker, int * lits, Result & result);
+
+	/*writes the stats of each assumption to a json or csv file, according to opts.cubeReport*/
+	int write2cubes(char * fileName, Options & opts);
+
+	/*wall time, in seconds, since the epoch*/
+	static double wallClock();
+
 };
 
 #endif
@@ -0,0 +1,85 @@
+/*PMSat -- Copyright (c) 2006-2007, Lus Gil
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include "Solver.h"
+
+/*
+Symmetries of the formula: permutations of the literals (g(~x) = ~g(x)) that map the set of clauses onto itself.
+They are the automorphisms of the clause-literal graph, with a vertex for each literal and for each clause, the
+edges between a clause and its literals and between the two literals of each variable. The literals and the
+clauses are told apart by their initial colors.
+
+findGenerators() computes generators of the group by individualization and refinement: the partition of the
+vertices is refined until the vertices of each cell have the same number of neighbours in every cell (equitable),
+a vertex of the first non-singleton cell of literals is individualized, and so on until the literals are
+discrete. The first path fixes u_0, u_1, ... and, from the deepest level up, each vertex w of the cell of u_i (and
+not in its orbit under the generators already found) is tried as the image of u_i, searching for a leaf of the
+same shape that is an automorphism. The search gives up after SYM_MAX_WORK steps of refinement, so that the
+generators are a subset of them on hard graphs, and it is deterministic (all the processes find the same ones).
+*/
+
+#define SYM_MAX_GENERATORS 64		// max generators kept
+#define SYM_MAX_WORK (1 << 26)		// max vertices and edges visited by the refinements of the search
+#define SYM_MAX_CHAIN 128		// max variables compared by the lex-leader constraint of each generator
+
+class Symmetry {
+	int n_vars, n_vertices;		//variables of the formula, vertices of the graph (literals first, by index())
+	vec<int> start, adj;		//neighbours of the vertex v: adj[start[v]] .. adj[start[v+1] - 1]
+	vec<vec<Lit> > gens, invs;	//image of each literal (by index()) under each generator and its inverse
+	int64 work;			//steps of refinement done
+	int stamp;			//mark of the vertex checked by isAutomorphism()
+
+	vec<uint64> hash;		//temporaries of refine()
+	vec<int> order, fresh;
+	vec<int> cell, mark, orbit;	//sizes of the cells, neighbours marked by isAutomorphism(), orbits (union-find)
+
+	int  refine(vec<int> &color, int n_colors);
+	int  targetCell(const vec<int> &color, int n_colors);
+	bool sameCells(const vec<int> &left, const vec<int> &right, int n_colors);
+	bool search(const vec<int> &left, const vec<int> &right, int n_colors);
+	bool leaf(const vec<int> &left, const vec<int> &right, int n_colors);
+	bool isAutomorphism(const vec<int> &perm);
+	int  findOrbit(int v);
+
+public:
+	/* builds the graph of the problem clauses of 'S' (at decision level 0) */
+	Symmetry(Solver &S);
+
+	/* computes the generators and returns how many */
+	int findGenerators();
+
+	int nGenerators() const { return gens.size(); }
+	Lit image(int g, Lit p) const { return gens[g][index(p)]; }
+	Lit preimage(int g, Lit p) const { return invs[g][index(p)]; }
+
+	/* adds to 'S' the lex-leader constraint of each generator (the assignment must be lexicographically smaller
+	   or equal than its image, over the variables moved in increasing order): at each position, the literal may
+	   only be greater than its image if a previous variable differs, which is told by an auxiliary variable.
+	   Returns the number of clauses added */
+	int addBreaking(Solver &S);
+};
+
+#endif
@@ -0,0 +1,94 @@
+/*PMSat -- Copyright (c) 2006-2007, Lus Gil
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Global.h"
+
+/*
+Instrumentation of the hot paths of the solver and of the communication, compiled only when
+the macro TRACE is defined (make TRACE=1). Without it all the macros below are empty.
+
+The time of each phase is measured with the cycle counter of the CPU and accumulated per phase.
+The calls longer than TRACE_MIN_CYCLES are also saved in a buffer and written, as complete events
+of the Chrome trace format (JSON array), to one file per rank. The timestamps are microseconds
+since the epoch, so the files of all ranks can be merged just by concatenating their events:
+
+  (echo "["; cat file-rank*.trace.json | grep "^{") > merged.json
+
+Workers never return from their loop (the master aborts them), so they write their buffer after
+each solve and the file is left without the closing bracket, which the trace viewers accept.
+*/
+
+enum TracePhase { PH_SOLVE, PH_PROPAGATE, PH_ANALYZE, PH_REDUCEDB, PH_SIMPLIFYDB, PH_ADDLEARNTS,
+		  PH_MPI_SEND, PH_MPI_RECV, PH_MPI_PROBE, PH_MPI_IPROBE, PH_COUNT };
+
+#ifdef TRACE
+
+#ifndef TRACE_MIN_CYCLES
+#define TRACE_MIN_CYCLES 2000	// shorter calls are only accumulated
+#endif
+
+#define TRACE_BUFFER_EVENTS 65536 // events kept in memory before writing them to the file
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64 traceClock() { return __rdtsc(); }
+#else
+#include <time.h>
+static inline uint64 traceClock() { struct timespec t; clock_gettime(CLOCK_MONOTONIC, &t); return (uint64) t.tv_sec * 1000000000ULL + t.tv_nsec; }
+#endif
+
+/* opens the trace file of the rank and calibrates the clock */
+void traceInit(int rank, const char * fileName);
+
+/* saves one call of a phase that started at the given clock */
+void traceEvent(int phase, uint64 start);
+
+/* writes the buffered events and the accumulated time of each phase */
+void traceFlush();
+
+/* measures the time between its construction and its destruction */
+class TraceScope {
+	int phase;
+	uint64 start;
+public:
+	TraceScope(int ph) : phase(ph), start(traceClock()) {}
+	~TraceScope() { traceEvent(phase, start); }
+};
+
+#define TRACE_INIT(rank, file)	traceInit(rank, file)
+#define TRACE_SCOPE(ph)		TraceScope trace_scope(ph)
+#define TRACE_CALL(ph, call)	do { TraceScope trace_call(ph); call; } while(0)
+#define TRACE_FLUSH()		traceFlush()
+
+#else
+
+#define TRACE_INIT(rank, file)
+#define TRACE_SCOPE(ph)
+#define TRACE_CALL(ph, call)	do { call; } while(0)
+#define TRACE_FLUSH()
+
+#endif
+
+#endif
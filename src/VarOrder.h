@@ -48,6 +48,7 @@ public:
     inline void update(Var x);                  // Called when variable increased in activity.
     inline void undo(Var x);                    // Called when variable is unassigned and may be selected again.
     inline Var  select(double random_freq =.0); // Selects a new, unassigned variable (or 'var_Undef' if none exists).
+    inline Var  best  (void);                   // The unassigned variable of highest activity, left in the order (or 'var_Undef' if none exists).
 };
 
 
@@ -92,5 +93,18 @@ Var VarOrder::select(double random_var_freq)
 }
 
 
+Var VarOrder::best(void)
+{
+    while (!heap.empty()){
+        Var next = heap.top();
+        if (toLbool(assigns[next]) == l_Undef)
+            return next;
+        heap.getmin();      // (assigned variables are inserted again by 'undo()')
+    }
+
+    return var_Undef;
+}
+
+
 //=================================================================================================
 #endif
@@ -0,0 +1,56 @@
+/*PMSat -- Copyright (c) 2006-2007, Lus Gil
+
+Permission is hereby granted, free of charge, to any person obtaining a
+copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+#ifndef WATCHSEARCH_H
+#define WATCHSEARCH_H
+
+#include "SolverTypes.h"
+
+/*
+Search of a new watch in a clause when its watched literal becomes false: the position of the first literal of
+lits[from..size) that is not false, or size if all of them are false. 'values' holds the value of each literal
+(a char with toInt() of the lbool) indexed by its code, as 'lit_values' of the Solver.
+
+The vector kernels read the values of 8 (AVX2) or 16 (AVX-512) literals with one gather of 4 bytes per literal,
+so 'values' must have 3 readable bytes after the value of the last literal. The remaining literals of the clause
+are searched one at a time. The widest kernel the cpu supports is chosen at startup.
+
+Most of the literals met by the searches of propagate are false, and there the gathers only pay off in long
+clauses: with 90% of false literals, watchbench measures AVX2 slower than the scalar kernel up to 64 literals and
+AVX-512 up to 16. Each kernel is only given the clauses from its own crossover on.
+*/
+
+#define WATCH_SEARCH_MIN 12		// min size of the clauses given to the scalar kernel (shorter ones are searched inline)
+#define WATCH_SEARCH_MIN_AVX2 64	// to the AVX2 one
+#define WATCH_SEARCH_MIN_AVX512 24	// and to the AVX-512 one
+
+typedef int (*WatchSearchFn)(const Lit *lits, int from, int size, const char *values);
+
+extern WatchSearchFn searchWatch;	// kernel used by the Solver
+extern const char *searchWatchName;	// its name: "avx512", "avx2" or "scalar"
+extern int searchWatchMin;		// min size of the clauses given to it
+
+/* kernel by name, or NULL if the cpu does not support it (for the benchmark) */
+
+WatchSearchFn watchSearchKernel(const char *name);
+
+#endif
@@ -0,0 +1,200 @@
+#!/bin/bash
+#
+# bench.sh -- scaling benchmark of PMSat over the instances of the test/ directory
+#
+# Every instance of the selected families is solved once in LOCAL mode and then with each
+# combination of number of MPI processes and search mode. The answers are checked against the
+# expected status of the instance and the models of the satisfiable ones against the clauses.
+# At the end a summary per configuration is printed with the number of solved and wrong answers,
+# the PAR-2 score (unsolved instances count as twice the timeout), the speedup and efficiency
+# against the LOCAL run and the ratio against the reference times of the 'mean' and 'results' files.
+#
+# The exit status is 1 if any answer or model was wrong.
+#
+# Usage: bench.sh [options]
+#   -b <file>     pmsat executable (default ../src/pmsat)
+#   -f "<dirs>"   families to run, the directory names inside test/ (default: all of them)
+#   -k <value>    max number of instances per family (default 5, 0 for all)
+#   -n "<list>"   numbers of MPI processes to try (default "2 4")
+#   -m "<list>"   search modes to try, as in the -m option of pmsat (default "r")
+#   -x "<args>"   extra arguments for pmsat (e.g. "-l -e")
+#   -t <secs>     timeout of each run (default 300)
+#   -r <solver>   reference solver of the 'mean' files (default "minisat (minisat)")
+#   -o <file>     also write the time of every run to this file
+#
+# The MPIRUN environment variable sets the command used to start the processes (default "mpirun").
+
+TESTDIR=$(cd "$(dirname "$0")" && pwd)
+PMSAT=$TESTDIR/../src/pmsat
+FAMILIES=""
+MAXINST=5
+NPROCS="2 4"
+MODES="r"
+EXTRA=""
+TIMEOUT=300
+REFSOLVER="minisat (minisat)"
+RUNSFILE=""
+MPIRUN=${MPIRUN:-mpirun}
+
+while getopts "b:f:k:n:m:x:t:r:o:h" opt; do
+	case $opt in
+		b) PMSAT=$OPTARG ;;
+		f) FAMILIES=$OPTARG ;;
+		k) MAXINST=$OPTARG ;;
+		n) NPROCS=$OPTARG ;;
+		m) MODES=$OPTARG ;;
+		x) EXTRA=$OPTARG ;;
+		t) TIMEOUT=$OPTARG ;;
+		r) REFSOLVER=$OPTARG ;;
+		o) RUNSFILE=$OPTARG ;;
+		*) sed -n '/^# Usage/,/^# The MPIRUN/s/^# \{0,1\}//p' "$0"; exit 2 ;;
+	esac
+done
+
+if [ ! -x "$PMSAT" ]; then
+	echo "ERROR! $PMSAT not found, build it first with make" >&2
+	exit 2
+fi
+
+if [ -z "$FAMILIES" ]; then
+	FAMILIES=$(cd "$TESTDIR" && for d in */; do ls "$d"*.cnf >/dev/null 2>&1 && echo "${d%/}"; done)
+fi
+
+WORK=$(mktemp -d /tmp/pmsat-bench.XXXXXX)
+trap 'rm -rf "$WORK"' EXIT
+RUNS=$WORK/runs
+REFS=$WORK/refs
+: > "$RUNS"
+
+# expected status of an instance: SAT, UNSAT or UNKNOWN (only the model is checked)
+expected() {
+	case $1 in
+		uuf*|bf/*|dubois/*|pigeon/*|pret/*|ssa/ssa0432*|ssa/ssa2670*|ssa/ssa6288*) echo UNSAT ;;
+		hanoi/*|ssa/ssa7552*) echo SAT ;;
+		*)	if grep -qi "^c.*not satisfiable" "$TESTDIR/$1"; then echo UNSAT
+			elif grep -qi "^c.*satisfiable" "$TESTDIR/$1"; then echo SAT
+			else echo UNKNOWN; fi ;;
+	esac
+}
+
+# checks that the model in the result file satisfies all the clauses of the instance
+checkModel() {
+	awk 'BEGIN { nClauses = 0 }
+	FNR == NR {
+		if ($1 == "c" || $1 == "p" || $1 == "%") next
+		for (i = 1; i <= NF; i++) {
+			if ($i == 0) { if (size) nClauses++; size = 0; continue }
+			lits[nClauses, size++] = $i; clauseSize[nClauses] = size
+		}
+		next
+	}
+	FNR > 1 { for (i = 1; i <= NF; i++) if ($i != 0) model[$i] = 1 }
+	END {
+		if (size) nClauses++
+		for (c = 0; c < nClauses; c++) {
+			sat = 0
+			for (i = 0; i < clauseSize[c] && !sat; i++) if (lits[c, i] in model) sat = 1
+			if (!sat) exit 1
+		}
+	}' "$1" "$2"
+}
+
+# runs pmsat with the given number of processes and mode on an instance and appends the outcome to the runs file
+run() {
+	local np=$1 mode=$2 inst=$3 exp=$4
+	local out=$WORK/out status start end elapsed
+
+	rm -f "$out"
+	start=$(date +%s.%N)
+	if [ "$np" = 1 ]; then
+		# started as a singleton, mpirun takes a couple of seconds to shut down after the non-zero exit code
+		timeout "$TIMEOUT" "$PMSAT" -m "$mode" $EXTRA "$TESTDIR/$inst" "$out" >/dev/null 2>&1 </dev/null
+	else
+		timeout "$TIMEOUT" $MPIRUN -np "$np" "$PMSAT" -m "$mode" $EXTRA "$TESTDIR/$inst" "$out" >/dev/null 2>&1 </dev/null
+	fi
+	end=$(date +%s.%N)
+	elapsed=$(awk -v s="$start" -v e="$end" 'BEGIN { printf "%.3f", e - s }')
+
+	status=$(head -1 "$out" 2>/dev/null | tr -d '\r')
+	if [ "$status" != SAT ] && [ "$status" != UNSAT ]; then
+		status=TIMEOUT
+	elif [ "$exp" != UNKNOWN ] && [ "$status" != "$exp" ]; then
+		echo "WRONG ANSWER: $inst with -np $np -m $mode is $status, expected $exp" >&2
+		status=WRONG
+	elif [ "$status" = SAT ] && ! checkModel "$TESTDIR/$inst" "$out"; then
+		echo "WRONG MODEL: $inst with -np $np -m $mode" >&2
+		status=WRONG
+	fi
+
+	echo "$inst $np $mode $status $elapsed" >> "$RUNS"
+	printf "  %-28s -np %-3s -m %s  %-7s %8ss\n" "$inst" "$np" "$mode" "$status" "$elapsed"
+}
+
+# reference times: "instance time" for each instance solved by the reference solver
+for f in "$TESTDIR"/*/mean "$TESTDIR"/*/results; do
+	[ -f "$f" ] || continue
+	awk -F'|' -v solver="$REFSOLVER" '
+		/^Processing file/ { match($0, /[^\/]*\/[^\/]*\.cnf/); inst = substr($0, RSTART, RLENGTH) }
+		$1 ~ /^ *solver/ { for (i = 1; i <= NF; i++) if ($i ~ /CPU time/) col = i }
+		{ name = $1; gsub(/^ +| +$/, "", name) }
+		name == solver && $2 !~ /timeout/ { t = $col; gsub(/ /, "", t); print inst, t }' "$f"
+done > "$REFS"
+
+echo "PMSat benchmark: timeout ${TIMEOUT}s, processes \"$NPROCS\", modes \"$MODES\", extra args \"$EXTRA\""
+for fam in $FAMILIES; do
+	echo "$fam:"
+	insts=$(cd "$TESTDIR" && ls "$fam"/*.cnf | sort -V)
+	[ "$MAXINST" -gt 0 ] && insts=$(echo "$insts" | head -n "$MAXINST")
+	for inst in $insts; do
+		exp=$(expected "$inst")
+		run 1 l "$inst" "$exp"
+		for np in $NPROCS; do
+			for mode in $MODES; do
+				run "$np" "$mode" "$inst" "$exp"
+			done
+		done
+	done
+	# the result files of pmsat are written next to the instances
+	rm -f "$TESTDIR/$fam"/*.time "$TESTDIR/$fam"/*.xml "$TESTDIR/$fam"/*.json "$TESTDIR/$fam"/*.csv
+done
+
+[ -n "$RUNSFILE" ] && cp "$RUNS" "$RUNSFILE"
+
+# summary per configuration. The speedup is the sum of the LOCAL times over the sum of the times of the
+# configuration, both on the instances solved by the two, and the efficiency is the speedup per worker
+# (the master only distributes the assumptions). The reference ratio is computed the same way against the
+# times of the reference solver
+echo
+awk -v timeout="$TIMEOUT" '
+	FNR == NR { ref[$1] = $2; next }
+	{
+		conf = ($2 == 1) ? "LOCAL" : "-np " $2 " -m " $3
+		if (!(conf in n)) order[nConfs++] = conf
+		workers[conf] = ($2 == 1) ? 1 : $2 - 1
+		n[conf]++
+		solved = ($4 == "SAT" || $4 == "UNSAT")
+		if (solved) { nSolved[conf]++; par2[conf] += $5 } else par2[conf] += 2 * timeout
+		if ($4 == "WRONG") nWrong[conf]++
+		if (solved) time[conf, $1] = $5
+		if ($2 == 1) local[$1] = solved ? $5 : -1
+		insts[conf, n[conf]] = $1
+	}
+	END {
+		printf "%-16s %6s %6s %6s %10s %8s %10s %10s\n", "configuration", "runs", "solved", "wrong", "PAR-2", "speedup", "efficiency", "vs ref"
+		for (c = 0; c < nConfs; c++) {
+			conf = order[c]; tLocal = tConf = rConf = tRef = 0
+			for (i = 1; i <= n[conf]; i++) {
+				inst = insts[conf, i]
+				if (!((conf, inst) in time)) continue
+				if (local[inst] >= 0) { tLocal += local[inst]; tConf += time[conf, inst] }
+				if (inst in ref) { tRef += ref[inst]; rConf += time[conf, inst] }
+			}
+			speedup = (tConf > 0) ? sprintf("%.2f", tLocal / tConf) : "-"
+			efficiency = (tConf > 0) ? sprintf("%.2f", tLocal / tConf / workers[conf]) : "-"
+			vsRef = (tRef > 0) ? sprintf("%.2f", rConf / tRef) : "-"
+			printf "%-16s %6d %6d %6d %10.2f %8s %10s %10s\n", conf, n[conf], nSolved[conf], nWrong[conf],
+				par2[conf] / n[conf], speedup, efficiency, vsRef
+		}
+	}' "$REFS" "$RUNS"
+
+! grep -q " WRONG " "$RUNS"